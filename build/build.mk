@@ -11,6 +11,11 @@ LD       := g++
 CXXFLAGS := -g -DSC_INCLUDE_DYNAMIC_PROCESSES -Wno-deprecated -Wall -I. -I$(SYSTEMC)/include -I../../include
 LDFLAGS  := -lm -lpthread $(EXTRA_LIBS)
 
+# Simulation-kernel instrumentation (inc/sim/sim_profiler.h): make CANON_SIM_PROFILE=1
+ifdef CANON_SIM_PROFILE
+CXXFLAGS += -DCANON_SIM_PROFILE
+endif
+
 TARGET_ARCH := linux64
 
 .PHONY: all clean
@@ -13,6 +13,7 @@
 
 #include <systemc.h>
 #include "alu_defs.h"
+#include "../sim/sim_profiler.h"
 
 
 SC_MODULE(alu_RV32I) {
@@ -31,10 +32,14 @@ SC_MODULE(alu_RV32I) {
 
     void alu_process(void);
 
+    proc_stats* prof_alu = nullptr;
+
     SC_CTOR(alu_RV32I) {
         SC_METHOD(alu_process);
         sensitive << data_a_in << data_b_in << imm_in << alu_func_in << alu_src_in;
         dont_initialize();
+
+        prof_alu = sim_profiler::instance().attach(this, "alu_process");
     }
 };
 
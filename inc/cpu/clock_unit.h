@@ -0,0 +1,66 @@
+/************************************************************
+ * Author: Mustafa Ergün
+ * Project: CANON MCU
+ * Submodule: Clock Unit
+ *
+ * Description:
+ *   Core clock generator with WFI clock gating. While the Control
+ *   Unit reports WFI and no interrupt is pending, no clock edges
+ *   are generated, so the SystemC kernel jumps straight to the
+ *   next timer or interrupt event instead of simulating idle cycles.
+ ************************************************************/
+
+#ifndef CLOCK_UNIT_H
+#define CLOCK_UNIT_H
+
+#include <systemc.h>
+#include "control_unit.h"
+
+SC_MODULE(clock_unit) {
+    // Inputs
+    sc_in<sc_uint<2>> sys_op_in;      // SYSTEM op from Control Unit
+    sc_in<bool>       irq_pending_in; // wake-up request from Interrupt Controller
+
+    // Output
+    sc_out<bool>      clk_out;        // core clock (to PC Unit)
+
+    sc_time period;                   // clock period
+
+    // Number of clock cycles skipped while sleeping in WFI
+    sc_dt::uint64 idle_cycles() const { return skipped; }
+
+    void clk_thread() {
+        while (true) {
+            // Evaluated before the edge that would retire the WFI
+            if (sys_op_in.read() == SYS_WFI && !irq_pending_in.read()) {
+                const sc_time sleep_start = sc_time_stamp();
+                wait(irq_pending_in.posedge_event());
+
+                // Resume on a period boundary to keep edges aligned
+                const sc_dt::uint64 phase = sc_time_stamp().value() % period.value();
+                if (phase != 0)
+                    wait(period - sc_time::from_value(phase));
+
+                skipped += (sc_time_stamp() - sleep_start).value() / period.value();
+            }
+
+            clk_out.write(true);
+            wait(period / 2);
+            clk_out.write(false);
+            wait(period / 2);
+        }
+    }
+
+    SC_HAS_PROCESS(clock_unit);
+
+    clock_unit(sc_module_name nm, const sc_time& clk_period = sc_time(10, SC_NS))
+        : sc_module(nm), period(clk_period) {
+        SC_THREAD(clk_thread);
+        clk_out.initialize(false);
+    }
+
+private:
+    sc_dt::uint64 skipped = 0;
+};
+
+#endif // CLOCK_UNIT_H
@@ -12,8 +12,12 @@
 #define CONTROL_H
 
 #include <systemc.h>
+#include "../sim/sim_profiler.h"
 
-enum OpClass : sc_uint<5> {
+// Operation class width: must hold every OpClass value (max 0x38)
+static constexpr int OPCLASS_BITS = 6;
+
+enum OpClass : sc_uint<OPCLASS_BITS> {
     OP_ALU    = 0x00,   // R/I arithmetic & logic (incl. ADDI, ANDI, SRLI, etc.)
     OP_LOAD   = 0x08,   // LB/LH/LW/LBU/LHU
     OP_STORE  = 0x18,   // SB/SH/SW
@@ -21,7 +25,8 @@ enum OpClass : sc_uint<5> {
     OP_JAL    = 0x20,
     OP_JALR   = 0x21,
     OP_LUI    = 0x30,
-    OP_AUIPC  = 0x31
+    OP_AUIPC  = 0x31,
+    OP_SYSTEM = 0x38    // WFI/ECALL/EBREAK (subtype passed in funct3_in as SysOp)
 };
 
 // PC operation select
@@ -30,12 +35,15 @@ enum PCOp : sc_uint<2> { PC_PLUS4=0, PC_BRANCH=1, PC_JAL=2, PC_JALR=3 };
 // Memory operation 
 enum MemOp : sc_uint<2> { MEM_NONE=0, MEM_LOAD=1, MEM_STORE=2 };
 
-// Write-back source select
+// Write-back source select (WB_PC4 is PC+2 after a compressed JAL/JALR)
 enum WBSel : sc_uint<2> { WB_ALU=0, WB_LOAD=1, WB_PC4=2 };
 
+// SYSTEM operation select
+enum SysOp : sc_uint<2> { SYS_NONE=0, SYS_WFI=1, SYS_ECALL=2, SYS_EBREAK=3 };
+
 SC_MODULE(control_unit) {
     // Inputs
-    sc_in<sc_uint<5>>  alu_op_in;    // decoded ALU op 
+    sc_in<sc_uint<OPCLASS_BITS>> alu_op_in; // decoded operation class
     sc_in<sc_uint<3>> funct3_in;     // Memory mode
 
     sc_in<sc_uint<3>>  br_flags_in;  // {eq, lt_s, lt_u} from ALU
@@ -50,13 +58,19 @@ SC_MODULE(control_unit) {
     sc_out<sc_uint<2>> mem_op_out;   // 00=NONE, 01=LOAD, 10=STORE to Memory
     sc_out<sc_uint<3>> mem_mode_out; // 000=LB, 001=LH, 010=LW, 100=LBU, 101=LHU to Memory
 
+    sc_out<sc_uint<2>> sys_op_out;   // 00=NONE, 01=WFI, 10=ECALL, 11=EBREAK to Clock/Semihost Unit
+
     // Combinational process
     void comb();
 
+    proc_stats* prof_comb = nullptr;
+
     SC_CTOR(control_unit) {
         SC_METHOD(comb);
         sensitive << alu_op_in << br_flags_in << funct3_in;
         dont_initialize();
+
+        prof_comb = sim_profiler::instance().attach(this, "comb");
     }
 };
 
@@ -6,6 +6,8 @@
  * Description:
  *   The Decoder interprets the data instruction and generates
  *   control signals for the CPU's various functional units.
+ *   RV32C instructions are expanded to RV32I before decoding;
+ *   RV32I decoding is driven by decoder_table_RV32I.h.
  ************************************************************/
 
 #ifndef DECODER_RV32I_H
@@ -14,6 +16,8 @@
 #include <systemc.h>
 #include "control_unit.h"
 #include "alu_defs.h"
+#include "rvc_expander.h"
+#include "../sim/sim_profiler.h"
 
 // 7-bit base opcodes (RV32I)
 enum Opcode7 : sc_uint<7> {
@@ -30,6 +34,11 @@ enum Opcode7 : sc_uint<7> {
     OPCODE_SYSTEM= 0b1110011  // 0x73
 };
 
+// Fixed SYSTEM encodings
+static constexpr uint32_t INSTR_ECALL  = 0x00000073;
+static constexpr uint32_t INSTR_EBREAK = 0x00100073;
+static constexpr uint32_t INSTR_WFI    = 0x10500073;
+
 SC_MODULE(decoder_RV32I) {
     // Input
     sc_in<sc_uint<32>> instr_in;  // Data instruction
@@ -39,18 +48,28 @@ SC_MODULE(decoder_RV32I) {
     sc_out<sc_uint<5>> rs2;    // Source register 2
     sc_out<sc_uint<5>> rd;     // Destination register
 
-    sc_out<sc_uint<5>> op_class;    // Operation class
+    sc_out<sc_uint<OPCLASS_BITS>> op_class; // Operation class
     sc_out<sc_uint<3>> memMode;     // Memory mode
 
     sc_out<sc_uint<4>> alu_func;     // ALU function
     sc_out<sc_uint<1>> alu_src;      // ALU source
     sc_out<sc_int<32>> imm_out;     // Immediate value
 
+    sc_out<bool>       compressed_out; // 1 = 16-bit instruction (PC+2) to PC Unit
+
     void decode_proc(void);
 
+    rvc_decode_cache rvc_cache;     // halfword -> expanded RV32I instruction
+
+    proc_stats* prof_decode = nullptr;
+
         SC_CTOR(decoder_RV32I) {
             SC_METHOD(decode_proc);
             sensitive << instr_in;
             dont_initialize();
+
+            prof_decode = sim_profiler::instance().attach(this, "decode_proc");
     }
 };
+
+#endif // DECODER_RV32I_H
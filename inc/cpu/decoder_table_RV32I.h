@@ -0,0 +1,259 @@
+/************************************************************
+ * Author: Mustafa Ergün
+ * Project: CANON MCU
+ * File: decoder_table_RV32I.h
+ *
+ * Purpose:
+ *   Declarative RV32I instruction table and the decoder that is
+ *   generated from it at compile time. Each row gives mask/match,
+ *   immediate format, OpClass and ALUFunc; a flat lookup table
+ *   indexed by {inst[30], funct3, opcode[6:2]} is built from the
+ *   rows by constexpr code. Adding instructions means adding rows.
+ ************************************************************/
+
+#ifndef DECODER_TABLE_RV32I_H
+#define DECODER_TABLE_RV32I_H
+
+#include <array>
+#include <cstdint>
+#include "control_unit.h"
+#include "alu_defs.h"
+
+// Opcode7 / INSTR_* encodings
+#include "decoder_RV32I.h"
+
+// Immediate formats
+enum ImmFmt : uint8_t {
+    FMT_NONE = 0,   // R-type / no immediate
+    FMT_I,
+    FMT_SHAMT,      // I-type shift: imm = inst[24:20]
+    FMT_S,
+    FMT_B,
+    FMT_U,
+    FMT_J,
+    FMT_COUNT
+};
+
+// Row flags: which fields are used
+enum DecFlag : uint8_t {
+    DF_RD      = 1 << 0,
+    DF_RS1     = 1 << 1,
+    DF_RS2     = 1 << 2,
+    DF_IMM     = 1 << 3,   // ALU source = imm
+    DF_MODE_F3 = 1 << 4    // mem_mode = funct3 (else row.mode)
+};
+
+struct instr_desc {
+    uint32_t mask;
+    uint32_t match;
+    uint8_t  fmt;      // ImmFmt
+    uint8_t  opcls;    // OpClass
+    uint8_t  alu;      // ALUFunc
+    uint8_t  flags;    // DecFlag
+    uint8_t  mode;     // mem_mode when !DF_MODE_F3 (e.g. SysOp)
+};
+
+// Decode result
+struct rv32_decoded {
+    uint8_t rd, rs1, rs2;
+    uint8_t opcls;
+    uint8_t mem_mode;
+    uint8_t alu;
+    uint8_t alu_src;
+    int32_t imm;
+};
+
+namespace rv32_table {
+
+// --------- row builders ---------
+static constexpr uint32_t M_OPC = 0x0000007F;   // opcode
+static constexpr uint32_t M_F3  = 0x0000707F;   // opcode + funct3
+static constexpr uint32_t M_F7  = 0xFE00707F;   // opcode + funct3 + funct7
+static constexpr uint32_t M_ALL = 0xFFFFFFFF;
+
+static constexpr uint32_t enc(uint32_t op, uint32_t f3 = 0, uint32_t f7 = 0) {
+    return op | (f3 << 12) | (f7 << 25);
+}
+
+static constexpr uint8_t RI    = DF_RD | DF_RS1 | DF_IMM;            // rd, rs1, imm
+static constexpr uint8_t RR    = DF_RD | DF_RS1 | DF_RS2;            // rd, rs1, rs2
+static constexpr uint8_t RD_I  = DF_RD | DF_IMM;                     // rd, imm
+static constexpr uint8_t LD    = DF_RD | DF_RS1 | DF_IMM | DF_MODE_F3;
+static constexpr uint8_t ST    = DF_RS1 | DF_RS2 | DF_IMM | DF_MODE_F3;
+static constexpr uint8_t BR    = DF_RS1 | DF_RS2 | DF_MODE_F3;
+
+// --------- instruction table ---------
+static constexpr instr_desc rows[] = {
+    //  mask   match                                  fmt        OpClass    ALUFunc   flags mode
+    // U/J-type
+    { M_OPC, enc(OPCODE_LUI),                        FMT_U,     OP_LUI,    ALU_ADD,  RD_I, 0 },  // LUI
+    { M_OPC, enc(OPCODE_AUIPC),                      FMT_U,     OP_AUIPC,  ALU_ADD,  RD_I, 0 },  // AUIPC
+    { M_OPC, enc(OPCODE_JAL),                        FMT_J,     OP_JAL,    ALU_ADD,  RD_I, 0 },  // JAL
+    { M_F3,  enc(OPCODE_JALR, 0b000),                FMT_I,     OP_JALR,   ALU_ADD,  RI,   0 },  // JALR
+
+    // Branches (funct3 passed to control as branch subtype)
+    { M_F3,  enc(OPCODE_BRANCH, 0b000),              FMT_B,     OP_BRANCH, ALU_SUB,  BR,   0 },  // BEQ
+    { M_F3,  enc(OPCODE_BRANCH, 0b001),              FMT_B,     OP_BRANCH, ALU_SUB,  BR,   0 },  // BNE
+    { M_F3,  enc(OPCODE_BRANCH, 0b100),              FMT_B,     OP_BRANCH, ALU_SUB,  BR,   0 },  // BLT
+    { M_F3,  enc(OPCODE_BRANCH, 0b101),              FMT_B,     OP_BRANCH, ALU_SUB,  BR,   0 },  // BGE
+    { M_F3,  enc(OPCODE_BRANCH, 0b110),              FMT_B,     OP_BRANCH, ALU_SUB,  BR,   0 },  // BLTU
+    { M_F3,  enc(OPCODE_BRANCH, 0b111),              FMT_B,     OP_BRANCH, ALU_SUB,  BR,   0 },  // BGEU
+
+    // Loads / stores (address = rs1 + imm)
+    { M_F3,  enc(OPCODE_LOAD, 0b000),                FMT_I,     OP_LOAD,   ALU_ADD,  LD,   0 },  // LB
+    { M_F3,  enc(OPCODE_LOAD, 0b001),                FMT_I,     OP_LOAD,   ALU_ADD,  LD,   0 },  // LH
+    { M_F3,  enc(OPCODE_LOAD, 0b010),                FMT_I,     OP_LOAD,   ALU_ADD,  LD,   0 },  // LW
+    { M_F3,  enc(OPCODE_LOAD, 0b100),                FMT_I,     OP_LOAD,   ALU_ADD,  LD,   0 },  // LBU
+    { M_F3,  enc(OPCODE_LOAD, 0b101),                FMT_I,     OP_LOAD,   ALU_ADD,  LD,   0 },  // LHU
+    { M_F3,  enc(OPCODE_STORE, 0b000),               FMT_S,     OP_STORE,  ALU_ADD,  ST,   0 },  // SB
+    { M_F3,  enc(OPCODE_STORE, 0b001),               FMT_S,     OP_STORE,  ALU_ADD,  ST,   0 },  // SH
+    { M_F3,  enc(OPCODE_STORE, 0b010),               FMT_S,     OP_STORE,  ALU_ADD,  ST,   0 },  // SW
+
+    // I-type ALU
+    { M_F3,  enc(OPCODE_OPIMM, 0b000),               FMT_I,     OP_ALU,    ALU_ADD,  RI,   0 },  // ADDI
+    { M_F3,  enc(OPCODE_OPIMM, 0b010),               FMT_I,     OP_ALU,    ALU_SLT,  RI,   0 },  // SLTI
+    { M_F3,  enc(OPCODE_OPIMM, 0b011),               FMT_I,     OP_ALU,    ALU_SLTU, RI,   0 },  // SLTIU
+    { M_F3,  enc(OPCODE_OPIMM, 0b100),               FMT_I,     OP_ALU,    ALU_XOR,  RI,   0 },  // XORI
+    { M_F3,  enc(OPCODE_OPIMM, 0b110),               FMT_I,     OP_ALU,    ALU_OR,   RI,   0 },  // ORI
+    { M_F3,  enc(OPCODE_OPIMM, 0b111),               FMT_I,     OP_ALU,    ALU_AND,  RI,   0 },  // ANDI
+    { M_F7,  enc(OPCODE_OPIMM, 0b001, 0b0000000),    FMT_SHAMT, OP_ALU,    ALU_SLL,  RI,   0 },  // SLLI
+    { M_F7,  enc(OPCODE_OPIMM, 0b101, 0b0000000),    FMT_SHAMT, OP_ALU,    ALU_SRL,  RI,   0 },  // SRLI
+    { M_F7,  enc(OPCODE_OPIMM, 0b101, 0b0100000),    FMT_SHAMT, OP_ALU,    ALU_SRA,  RI,   0 },  // SRAI
+
+    // R-type ALU
+    { M_F7,  enc(OPCODE_OP, 0b000, 0b0000000),       FMT_NONE,  OP_ALU,    ALU_ADD,  RR,   0 },  // ADD
+    { M_F7,  enc(OPCODE_OP, 0b000, 0b0100000),       FMT_NONE,  OP_ALU,    ALU_SUB,  RR,   0 },  // SUB
+    { M_F7,  enc(OPCODE_OP, 0b001, 0b0000000),       FMT_NONE,  OP_ALU,    ALU_SLL,  RR,   0 },  // SLL
+    { M_F7,  enc(OPCODE_OP, 0b010, 0b0000000),       FMT_NONE,  OP_ALU,    ALU_SLT,  RR,   0 },  // SLT
+    { M_F7,  enc(OPCODE_OP, 0b011, 0b0000000),       FMT_NONE,  OP_ALU,    ALU_SLTU, RR,   0 },  // SLTU
+    { M_F7,  enc(OPCODE_OP, 0b100, 0b0000000),       FMT_NONE,  OP_ALU,    ALU_XOR,  RR,   0 },  // XOR
+    { M_F7,  enc(OPCODE_OP, 0b101, 0b0000000),       FMT_NONE,  OP_ALU,    ALU_SRL,  RR,   0 },  // SRL
+    { M_F7,  enc(OPCODE_OP, 0b101, 0b0100000),       FMT_NONE,  OP_ALU,    ALU_SRA,  RR,   0 },  // SRA
+    { M_F7,  enc(OPCODE_OP, 0b110, 0b0000000),       FMT_NONE,  OP_ALU,    ALU_OR,   RR,   0 },  // OR
+    { M_F7,  enc(OPCODE_OP, 0b111, 0b0000000),       FMT_NONE,  OP_ALU,    ALU_AND,  RR,   0 },  // AND
+
+    // FENCE / FENCE.I: NOP for now
+    { M_OPC, enc(OPCODE_FENCE),                      FMT_NONE,  OP_ALU,    ALU_ADD,  0,    0 },  // FENCE
+
+    // SYSTEM (subtype passed to control in mem_mode); CSRs not decoded yet
+    { M_ALL, INSTR_ECALL,                            FMT_NONE,  OP_SYSTEM, ALU_ADD,  0, SYS_ECALL  },  // ECALL
+    { M_ALL, INSTR_EBREAK,                           FMT_NONE,  OP_SYSTEM, ALU_ADD,  0, SYS_EBREAK },  // EBREAK
+    { M_ALL, INSTR_WFI,                              FMT_NONE,  OP_SYSTEM, ALU_ADD,  0, SYS_WFI    },  // WFI
+};
+
+static constexpr int NUM_ROWS = sizeof(rows) / sizeof(rows[0]);
+
+// Every OpClass must survive the op_class port width
+static constexpr bool opcls_fit() {
+    for (int r = 0; r < NUM_ROWS; ++r)
+        if (rows[r].opcls >> OPCLASS_BITS) return false;
+    return true;
+}
+static_assert(opcls_fit(), "decoder table: OpClass wider than OPCLASS_BITS");
+
+// SYSTEM rows pass a SysOp in mem_mode; it must fit the 2-bit sys_op_out
+static constexpr bool sysop_fit() {
+    for (int r = 0; r < NUM_ROWS; ++r)
+        if (rows[r].opcls == OP_SYSTEM && (rows[r].mode == SYS_NONE || (rows[r].mode >> 2)))
+            return false;
+    return true;
+}
+static_assert(sysop_fit(), "decoder table: SYSTEM row with invalid SysOp");
+
+// --------- generated lookup table ---------
+// Index: {inst[30], funct3, opcode[6:2]} -> candidate rows in table order
+static constexpr int LUT_BITS      = 9;
+static constexpr int LUT_SIZE      = 1 << LUT_BITS;
+static constexpr int MAX_CANDIDATES = 3;
+static constexpr uint32_t KEY_MASK = 0x4000707C;  // bits covered by the index
+
+static constexpr uint32_t lut_index(uint32_t inst) {
+    return ((inst >> 2) & 0x1F) | (((inst >> 12) & 0x7) << 5) | (((inst >> 30) & 0x1) << 8);
+}
+
+static constexpr uint32_t lut_key_bits(uint32_t idx) {
+    return ((idx & 0x1F) << 2) | (((idx >> 5) & 0x7) << 12) | (((idx >> 8) & 0x1) << 30);
+}
+
+struct lut_entry {
+    uint8_t count;
+    uint8_t row[MAX_CANDIDATES];
+};
+
+struct decode_lut {
+    std::array<lut_entry, LUT_SIZE> entry;
+    bool overflow;
+};
+
+static constexpr decode_lut build_lut() {
+    decode_lut lut{};
+    for (int idx = 0; idx < LUT_SIZE; ++idx) {
+        const uint32_t key = lut_key_bits((uint32_t)idx);
+        lut_entry& e = lut.entry[idx];
+        for (int r = 0; r < NUM_ROWS; ++r) {
+            // Row can match this index if it agrees on every indexed bit it tests
+            if ((rows[r].match ^ key) & rows[r].mask & KEY_MASK) continue;
+            if (e.count == MAX_CANDIDATES) { lut.overflow = true; break; }
+            e.row[e.count++] = (uint8_t)r;
+        }
+    }
+    return lut;
+}
+
+static constexpr decode_lut lut = build_lut();
+static_assert(!lut.overflow, "decoder table: raise MAX_CANDIDATES");
+
+// --------- branch-free immediate extraction ---------
+// All formats are computed with shifts/masks and selected by index,
+// so there is no data-dependent branch or indirect call.
+static inline int32_t extract_imm(uint32_t inst, uint8_t fmt) {
+    const uint32_t sign = (uint32_t)((int32_t)inst >> 31);   // all ones if inst[31]
+    const uint32_t imm[FMT_COUNT] = {
+        0,                                                                     // NONE
+        (uint32_t)((int32_t)inst >> 20),                                       // I
+        (inst >> 20) & 0x1F,                                                   // SHAMT
+        (sign << 12) | ((inst >> 20) & 0xFE0) | ((inst >> 7) & 0x1F),          // S
+        (sign << 13) | ((inst >> 19) & 0x1000) | ((inst << 4) & 0x800) |
+            ((inst >> 20) & 0x7E0) | ((inst >> 7) & 0x1E),                     // B
+        inst & 0xFFFFF000u,                                                    // U
+        (sign << 21) | ((inst >> 11) & 0x100000) | (inst & 0xFF000) |
+            ((inst >> 9) & 0x800) | ((inst >> 20) & 0x7FE)                     // J
+    };
+    return (int32_t)imm[fmt];
+}
+
+} // namespace rv32_table
+
+// Decode one RV32I instruction; unknown encodings decode as NOP
+static inline rv32_decoded rv32_decode(uint32_t inst) {
+    using namespace rv32_table;
+
+    const lut_entry& e = lut.entry[lut_index(inst)];
+    for (int i = 0; i < e.count; ++i) {
+        const instr_desc& d = rows[e.row[i]];
+        if ((inst & d.mask) != d.match) continue;
+
+        // Field masks from flags (0 or all ones)
+        const uint32_t f     = d.flags;
+        const uint32_t m_rd  = 0u - (f & DF_RD);
+        const uint32_t m_rs1 = 0u - ((f & DF_RS1) >> 1);
+        const uint32_t m_rs2 = 0u - ((f & DF_RS2) >> 2);
+        const uint32_t m_f3  = 0u - ((f & DF_MODE_F3) >> 4);
+
+        rv32_decoded out;
+        out.rd       = (uint8_t)((inst >> 7)  & 0x1F & m_rd);
+        out.rs1      = (uint8_t)((inst >> 15) & 0x1F & m_rs1);
+        out.rs2      = (uint8_t)((inst >> 20) & 0x1F & m_rs2);
+        out.opcls    = d.opcls;
+        out.mem_mode = (uint8_t)((((inst >> 12) & 0x7) & m_f3) | (d.mode & ~m_f3));
+        out.alu      = d.alu;
+        out.alu_src  = (uint8_t)((f & DF_IMM) >> 3);
+        out.imm      = extract_imm(inst, d.fmt);
+        return out;
+    }
+
+    // NOP: no reg write, no mem op, imm=0
+    return rv32_decoded{ 0, 0, 0, OP_ALU, 0, ALU_ADD, 0, 0 };
+}
+
+#endif // DECODER_TABLE_RV32I_H
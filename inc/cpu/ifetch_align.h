@@ -0,0 +1,60 @@
+/************************************************************
+ * Author: Mustafa Ergün
+ * Project: CANON MCU
+ * Submodule: Instruction Fetch Aligner
+ *
+ * Description:
+ *   With the C extension the PC is only halfword aligned, so a
+ *   32-bit instruction may straddle two fetch words. The aligner
+ *   requests the word containing PC and the following word, and
+ *   presents the 32 bits starting at PC to the Decoder.
+ ************************************************************/
+
+#ifndef IFETCH_ALIGN_H
+#define IFETCH_ALIGN_H
+
+#include <systemc.h>
+
+SC_MODULE(ifetch_align) {
+    // Inputs
+    sc_in<sc_uint<32>> pc_in;       // current PC from PC Unit
+    sc_in<sc_uint<32>> word_lo_in;  // memory word at fetch_lo_addr_out
+    sc_in<sc_uint<32>> word_hi_in;  // memory word at fetch_hi_addr_out
+
+    // Outputs
+    sc_out<sc_uint<32>> fetch_lo_addr_out; // word-aligned address of PC
+    sc_out<sc_uint<32>> fetch_hi_addr_out; // next word (upper parcel on PC[1]=1)
+    sc_out<sc_uint<32>> instr_out;         // 32 bits starting at PC to Decoder
+
+    void addr_process() {
+        const sc_uint<32> base = pc_in.read() & ~sc_uint<32>(0b11);
+        fetch_lo_addr_out.write(base);
+        fetch_hi_addr_out.write(base + 4);
+    }
+
+    void align_process() {
+        const sc_uint<32> lo = word_lo_in.read();
+        const sc_uint<32> hi = word_hi_in.read();
+
+        if (pc_in.read()[1]) {
+            // PC on upper halfword: {hi[15:0], lo[31:16]}
+            sc_uint<32> inst;
+            inst.range(15, 0)  = lo.range(31, 16);
+            inst.range(31, 16) = hi.range(15, 0);
+            instr_out.write(inst);
+        } else {
+            instr_out.write(lo);
+        }
+    }
+
+    SC_CTOR(ifetch_align) {
+        SC_METHOD(addr_process);
+        sensitive << pc_in;
+
+        SC_METHOD(align_process);
+        sensitive << pc_in << word_lo_in << word_hi_in;
+        dont_initialize();
+    }
+};
+
+#endif // IFETCH_ALIGN_H
@@ -6,6 +6,7 @@
  * Description:
  *   RV32I Program Counter unit. Holds current PC and
  *   computes the next PC based on control (PC+4 / BRANCH / JAL / JALR).
+ *   With RV32C the sequential step is PC+2 for compressed instructions.
  *   Purely combinational interface; no clock here (LT VP style).
  ************************************************************/
 
@@ -13,9 +14,13 @@
 #define PC_UNIT_H
 
 #include <systemc.h>
+#include "../sim/sim_profiler.h"
 
 SC_MODULE(pc_unit) {
     // Inputs
+    sc_in<bool>        clk;
+    sc_in<bool>        reset_n;
+
     sc_in<sc_uint<2>>  pc_op_in;        // select (PC+4, BRANCH, JAL, JALR) from Control Unit
 
     sc_in<sc_uint<32>> boot_addr_in;    // reset vector from top level
@@ -24,18 +29,22 @@ SC_MODULE(pc_unit) {
     sc_in<sc_uint<32>> jal_target_in;       // JAL target address   from ALU
     sc_in<sc_uint<32>> jalr_target_in;      // JALR target address from ALU
 
+    sc_in<bool>        compressed_in;       // 16-bit instruction from Decoder
+
     // Outputs
     sc_out<sc_uint<32>> pc_out;       // current PC (to memory)
 
-    sc_out<sc_uint<32>> pc_plus4_out; // for WB on JAL/JALR to WB Mux
+    sc_out<sc_uint<32>> pc_plus4_out; // PC+4 (PC+2 if compressed) for WB on JAL/JALR to WB Mux
 
     // Internal PC register
     sc_signal<sc_uint<32>> pc_reg;
 
     // Next PC calculation
     void comb() {
+        proc_probe probe(prof_comb);
+
         sc_uint<32> pc  = pc_reg.read();
-        sc_uint<32> pc4 = pc + 4;
+        sc_uint<32> pc4 = pc + (compressed_in.read() ? 2 : 4);
         sc_uint<32> npc = pc4;
 
         switch (pc_op_in.read()) {
@@ -45,8 +54,9 @@ SC_MODULE(pc_unit) {
             case 3: npc = jalr_target_in.read(); break;
         }
 
-        pc_out.write(pc);
-        pc_plus4_out.write(pc4);
+        probe.write(pc_out, pc);
+        probe.write(pc_plus4_out, pc4);
+        probe.mark_changed(next_pc != npc);
         next_pc = npc;
     }
 
@@ -60,11 +70,18 @@ SC_MODULE(pc_unit) {
 
     sc_uint<32> next_pc; // temp
 
+    proc_stats* prof_comb = nullptr;
+
     SC_CTOR(pc_unit) {
         SC_METHOD(comb);
-        sensitive << pc_reg << pc_op_in << branch_target_in << jal_target_in << jalr_target_in;
+        sensitive << pc_reg << pc_op_in << branch_target_in << jal_target_in << jalr_target_in
+                  << compressed_in;
+
+        prof_comb = sim_profiler::instance().attach(this, "comb");
 
         SC_METHOD(seq);
         sensitive << clk.pos();
     }
 };
+
+#endif // PC_UNIT_H
@@ -9,7 +9,11 @@
  *   general-purpose registers.
  ************************************************************/
 
+#ifndef REGISTER_UNIT_H
+#define REGISTER_UNIT_H
+
  #include <systemc.h>
+ #include "../sim/sim_profiler.h"
  
  SC_MODULE(register_unit) {
     // Inputs 
@@ -32,8 +36,15 @@
 
     void comb_write(); // process: write operation
 
+    proc_stats* prof_read  = nullptr;
+    proc_stats* prof_write = nullptr;
+
     public:
 
+    // Backdoor access (debug / semihosting), bypasses the ports
+    sc_uint<32> read_reg(unsigned idx) const { return regs[idx & 31]; } // regs[0] stays 0
+    void write_reg(unsigned idx, sc_uint<32> val) { if ((idx & 31) != 0) regs[idx & 31] = val; }
+
     SC_CTOR(register_unit) {
         // Combinational read
         SC_METHOD(comb_read);
@@ -42,10 +53,15 @@
         SC_METHOD(comb_write);
         sensitive << we_in << rd_addr_in << wd_in;
 
+        prof_read  = sim_profiler::instance().attach(this, "comb_read");
+        prof_write = sim_profiler::instance().attach(this, "comb_write");
+
         data_a_out.initialize(0);
         data_b_out.initialize(0);
 
         // Ensure x0 is 0 
         regs[0] = 0;
     }
-};
\ No newline at end of file
+};
+
+#endif // REGISTER_UNIT_H
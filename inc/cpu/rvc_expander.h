@@ -0,0 +1,45 @@
+/************************************************************
+ * Author: Mustafa Ergün
+ * Project: CANON MCU
+ * Submodule: RVC Expander
+ *
+ * Description:
+ *   Expands 16-bit RV32C compressed instructions into their
+ *   32-bit RV32I equivalents. Every compressed encoding is a
+ *   pure function of its 16 bits, so each halfword is expanded
+ *   once and then served from a direct-mapped cache.
+ ************************************************************/
+
+#ifndef RVC_EXPANDER_H
+#define RVC_EXPANDER_H
+
+#include <cstdint>
+#include <vector>
+
+// An instruction is compressed unless its two low bits are 0b11
+static inline bool rvc_is_compressed(uint32_t inst) {
+    return (inst & 0b11u) != 0b11u;
+}
+
+// Expand one compressed instruction. Returns 0 (an illegal
+// RV32I encoding) for reserved / unsupported (F/D) encodings.
+uint32_t rvc_expand(uint16_t cinst);
+
+class rvc_decode_cache {
+public:
+    rvc_decode_cache() : expanded(1u << 16, 0), valid(1u << 16, false) {}
+
+    uint32_t lookup(uint16_t cinst) {
+        if (!valid[cinst]) {
+            expanded[cinst] = rvc_expand(cinst);
+            valid[cinst]    = true;
+        }
+        return expanded[cinst];
+    }
+
+private:
+    std::vector<uint32_t> expanded; // indexed by the raw halfword
+    std::vector<bool>     valid;
+};
+
+#endif // RVC_EXPANDER_H
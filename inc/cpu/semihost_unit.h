@@ -0,0 +1,126 @@
+/************************************************************
+ * Author: Mustafa Ergün
+ * Project: CANON MCU
+ * Submodule: Semihosting Unit
+ *
+ * Description:
+ *   RISC-V semihosting: services host I/O requests issued by the
+ *   guest with the semihosting EBREAK sequence
+ *     slli x0,x0,0x1f ; ebreak ; srai x0,x0,7
+ *   or with a plain ECALL. a0 holds the operation, a1 the
+ *   argument (block); the result is returned in a0.
+ *   Guest buffers are accessed in place through DMI pointers, so
+ *   host reads/writes go straight to/from guest memory. Only
+ *   regions granting the needed access (read, or write for
+ *   SYS_READ) are used; the bus must revoke regions through
+ *   invalidate_dmi() from its invalidate_direct_mem_ptr().
+ ************************************************************/
+
+#ifndef SEMIHOST_UNIT_H
+#define SEMIHOST_UNIT_H
+
+#include <systemc.h>
+#include <tlm.h>
+#include <vector>
+#include "control_unit.h"
+#include "register_unit.h"
+
+// Semihosting operation numbers (a0)
+enum SemihostOp : uint32_t {
+    SH_SYS_OPEN          = 0x01,
+    SH_SYS_CLOSE         = 0x02,
+    SH_SYS_WRITEC        = 0x03,
+    SH_SYS_WRITE0        = 0x04,
+    SH_SYS_WRITE         = 0x05,
+    SH_SYS_READ          = 0x06,
+    SH_SYS_READC         = 0x07,
+    SH_SYS_ISERROR       = 0x08,
+    SH_SYS_ISTTY         = 0x09,
+    SH_SYS_SEEK          = 0x0A,
+    SH_SYS_FLEN          = 0x0C,
+    SH_SYS_REMOVE        = 0x0E,
+    SH_SYS_CLOCK         = 0x10,
+    SH_SYS_TIME          = 0x11,
+    SH_SYS_ERRNO         = 0x13,
+    SH_SYS_EXIT          = 0x18,
+    SH_SYS_EXIT_EXTENDED = 0x20
+};
+
+// Semihosting sequence around the EBREAK
+static constexpr uint32_t SH_ENTRY_SLLI = 0x01F01013; // slli x0, x0, 0x1f
+static constexpr uint32_t SH_EXIT_SRAI  = 0x40705013; // srai x0, x0, 7
+
+// Buffered writer for host console/file output
+class buffered_writer {
+public:
+    explicit buffered_writer(int fd, size_t capacity = 64 * 1024);
+    ~buffered_writer();
+
+    // Returns number of bytes NOT written
+    size_t write(const void* data, size_t len);
+    void   flush();
+
+private:
+    int               fd;
+    std::vector<char> buf;
+    size_t            used = 0;
+};
+
+SC_MODULE(semihost_unit) {
+    // Inputs
+    sc_in<bool>        clk;
+    sc_in<sc_uint<2>>  sys_op_in;  // SYSTEM op from Control Unit
+    sc_in<sc_uint<32>> pc_in;      // current PC from PC Unit
+
+    // Elaboration-time binding
+    void bind_regs(register_unit& r) { regs = &r; }
+    void add_dmi(const tlm::tlm_dmi& dmi) { dmi_regions.push_back(dmi); }
+
+    // Drop every region overlapping [start, end] (tlm_bw_direct_mem_if)
+    void invalidate_dmi(sc_dt::uint64 start, sc_dt::uint64 end);
+
+    bool exited() const    { return has_exited; }
+    int  exit_code() const { return exit_status; }
+
+    SC_CTOR(semihost_unit) : console(1), handles(1, -1) {
+        SC_METHOD(exec);
+        sensitive << clk.pos();
+        dont_initialize();
+    }
+
+    ~semihost_unit();
+
+protected:
+    void end_of_simulation() override;
+
+private:
+    register_unit*             regs = nullptr;
+    std::vector<tlm::tlm_dmi>  dmi_regions;
+    buffered_writer            console;    // guest stdout (stderr is unbuffered)
+    std::vector<int>           handles;    // guest handle -> host fd (-1 = closed);
+                                           // slot 0 is reserved, valid handles are nonzero
+
+    int  host_errno  = 0;
+    bool has_exited  = false;
+    int  exit_status = 0;
+
+    void exec();
+    uint32_t call(uint32_t op, uint32_t arg);
+
+    // Guest memory through DMI; nullptr if [addr, addr+len) is not covered
+    // by a region allowing cmd (avail, if given, receives the bytes
+    // contiguous from addr)
+    unsigned char* guest_ptr(uint32_t addr, uint32_t len, tlm::tlm_command cmd,
+                             uint32_t* avail = nullptr);
+    bool read_word(uint32_t addr, uint32_t& val);
+
+    uint32_t sys_open(uint32_t name, uint32_t mode, uint32_t len);
+    uint32_t sys_write(uint32_t handle, uint32_t buf, uint32_t len);
+    uint32_t sys_read(uint32_t handle, uint32_t buf, uint32_t len);
+    uint32_t sys_write0(uint32_t str);
+    void     sys_exit(uint32_t reason, uint32_t subcode);
+
+    int  host_fd(uint32_t handle) const;
+};
+
+#endif // SEMIHOST_UNIT_H
@@ -12,30 +12,35 @@
 #define WB_MUX_H
 
 #include <systemc.h>
+#include "../sim/sim_profiler.h"
 
 SC_MODULE(wb_mux) {
     // Inputs
     sc_in<sc_uint<32>> alu_in;   // ALU result
     sc_in<sc_uint<32>> load_in;  // Data loaded from memory
-    sc_in<sc_uint<32>> pc4_in;   // PC + 4
+    sc_in<sc_uint<32>> pc4_in;   // PC + 4 (PC + 2 if compressed)
     sc_in<sc_uint<2>>  wb_sel_in; // Write-back select from Control Unit
 
     // Output
     sc_out<sc_uint<32>> wb_out;  // Data to write to Register Unit
 
+    proc_stats* prof_mux = nullptr;
+
     void mux_process() {
+        proc_probe probe(prof_mux);
+
         switch (wb_sel_in.read()) {
             case 0: // WB_ALU
-                wb_out.write(alu_in.read());
+                probe.write(wb_out, alu_in.read());
                 break;
             case 1: // WB_LOAD
-                wb_out.write(load_in.read());
+                probe.write(wb_out, load_in.read());
                 break;
             case 2: // WB_PC4
-                wb_out.write(pc4_in.read());
+                probe.write(wb_out, pc4_in.read());
                 break;
             default:
-                wb_out.write(0); // Safe default
+                probe.write(wb_out, 0); // Safe default
                 break;
         }
     }
@@ -44,6 +49,8 @@ SC_MODULE(wb_mux) {
         SC_METHOD(mux_process);
         sensitive << alu_in << load_in << pc4_in << wb_sel_in;
         dont_initialize();
+
+        prof_mux = sim_profiler::instance().attach(this, "mux_process");
     }
 };
 
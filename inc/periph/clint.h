@@ -0,0 +1,55 @@
+/************************************************************
+ * Author: Mustafa Ergün
+ * Project: CANON MCU
+ * Submodule: CLINT (Core-Local Interruptor)
+ *
+ * Description:
+ *   Machine timer (mtime/mtimecmp) and software interrupt (msip).
+ *   mtime is derived from simulation time rather than counted
+ *   per cycle; the timer interrupt is a single event scheduled
+ *   at the moment mtime reaches mtimecmp.
+ ************************************************************/
+
+#ifndef CLINT_H
+#define CLINT_H
+
+#include <systemc.h>
+
+// Register offsets (SiFive CLINT layout)
+enum ClintReg : uint32_t {
+    CLINT_MSIP        = 0x0000,
+    CLINT_MTIMECMP_LO = 0x4000,
+    CLINT_MTIMECMP_HI = 0x4004,
+    CLINT_MTIME_LO    = 0xBFF8,
+    CLINT_MTIME_HI    = 0xBFFC
+};
+
+SC_MODULE(clint) {
+    // Outputs
+    sc_out<bool> msip_out;   // software interrupt to Interrupt Controller
+    sc_out<bool> mtip_out;   // timer interrupt to Interrupt Controller
+
+    // Register access (from bus)
+    uint32_t read(uint32_t offset);
+    void     write(uint32_t offset, uint32_t value);
+
+    sc_dt::uint64 mtime() const;
+
+    SC_HAS_PROCESS(clint);
+
+    clint(sc_module_name nm, const sc_time& tick = sc_time(1, SC_US));
+
+private:
+    sc_time       tick_period;      // mtime increment period
+    sc_dt::uint64 mtime_offset = 0; // mtime = offset + elapsed ticks
+    sc_dt::uint64 mtimecmp     = ~sc_dt::uint64(0);
+    bool          msip         = false;
+
+    sc_event update_ev;  // register write
+    sc_event timer_ev;   // mtime reaches mtimecmp
+
+    void schedule_timer();
+    void update_proc();
+};
+
+#endif // CLINT_H
@@ -0,0 +1,65 @@
+/************************************************************
+ * Author: Mustafa Ergün
+ * Project: CANON MCU
+ * Submodule: Interrupt Controller
+ *
+ * Description:
+ *   Collects the CLINT software/timer interrupts and external
+ *   edge-triggered lines (e.g. GPIO) into a pending register,
+ *   masks them with an enable register and signals the CPU.
+ *   Purely event driven; nothing is evaluated per clock.
+ ************************************************************/
+
+#ifndef IRQ_CTRL_H
+#define IRQ_CTRL_H
+
+#include <systemc.h>
+
+// Register offsets
+enum IrqReg : uint32_t {
+    IRQ_PENDING = 0x0,  // RO for MSIP/MTIP, write-1-to-clear for external lines
+    IRQ_ENABLE  = 0x4
+};
+
+// Pending/enable bit positions
+enum IrqBit : int {
+    IRQ_MSIP = 0,
+    IRQ_MTIP = 1,
+    IRQ_EXT0 = 2        // external line n is bit IRQ_EXT0 + n
+};
+
+SC_MODULE(irq_ctrl) {
+    static constexpr int IRQ_LINES = 8;
+
+    // Inputs
+    sc_in<bool> msip_in;                // from CLINT
+    sc_in<bool> mtip_in;                // from CLINT
+    sc_in<bool> ext_irq_in[IRQ_LINES];  // rising-edge triggered (GPIO, ...)
+
+    // Output
+    sc_out<bool> irq_pending_out;       // enabled interrupt pending (to Clock Unit / CPU)
+
+    // Register access (from bus)
+    uint32_t read(uint32_t offset);
+    void     write(uint32_t offset, uint32_t value);
+
+    SC_CTOR(irq_ctrl) {
+        SC_METHOD(comb);
+        sensitive << msip_in << mtip_in << update_ev;
+        for (int i = 0; i < IRQ_LINES; ++i)
+            sensitive << ext_irq_in[i].pos();
+
+        irq_pending_out.initialize(false);
+    }
+
+private:
+    uint32_t ext_pending = 0;   // latched external edges (IRQ_EXT0..)
+    uint32_t enable      = 0;
+
+    sc_event update_ev;         // register write
+
+    uint32_t pending() const;
+    void comb();
+};
+
+#endif // IRQ_CTRL_H
@@ -0,0 +1,204 @@
+/************************************************************
+ * Author: Mustafa Ergün
+ * Project: CANON MCU
+ * Submodule: Simulation Profiler
+ *
+ * Description:
+ *   Instrumentation of the SystemC models: per-SC_METHOD
+ *   activation counts, activations that changed no output,
+ *   delta cycles in each rising-edge time step and sampled host
+ *   time (RDTSC).
+ *   Results are exported as a text report and as a Chrome
+ *   trace-event JSON timeline (chrome://tracing, Perfetto).
+ *
+ *   Compiled in only with -DCANON_SIM_PROFILE; otherwise every
+ *   probe is an empty inline and port writes pass straight through.
+ ************************************************************/
+
+#ifndef SIM_PROFILER_H
+#define SIM_PROFILER_H
+
+#include <systemc.h>
+#include <cstdint>
+#include <deque>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Per-process counters
+struct proc_stats {
+    std::string name;
+    uint32_t    tid             = 0;  // trace row
+    uint64_t    activations     = 0;
+    uint64_t    no_change       = 0;  // activations that changed no output/state
+    uint64_t    samples         = 0;  // timed activations
+    uint64_t    sampled_ticks   = 0;  // host ticks over timed activations
+};
+
+#ifdef CANON_SIM_PROFILE
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+static inline uint64_t host_ticks() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+class sim_profiler {
+public:
+    static sim_profiler& instance();
+
+    // Register <module>.<proc>; the returned pointer stays valid
+    proc_stats* attach(const sc_module* owner, const char* proc);
+
+    // Time one in 2^shift activations (default 1/16)
+    void set_sample_shift(unsigned shift) { sample_mask = (1ull << shift) - 1; }
+    void set_max_trace_events(size_t n)   { max_trace_events = n; }
+
+    bool sample(const proc_stats* s) const { return (s->activations & sample_mask) == 0; }
+    void trace_activation(const proc_stats* s, uint64_t t0, uint64_t t1);
+    void clock_edge();          // rising edge seen
+    void clock_edge_step_end(); // first activation after the edge's time step
+
+    void write_report(std::ostream& os) const;
+    bool write_chrome_trace(const std::string& path) const;
+
+private:
+    sim_profiler();
+
+    struct trace_event {
+        uint64_t host_t0;
+        uint64_t host_dur;
+        uint64_t sim_ps;
+        uint32_t tid;       // process row, or EDGE_TID for clock edges
+        uint32_t deltas;    // clock edges only
+    };
+    static constexpr uint32_t EDGE_TID = 0;
+
+    std::deque<proc_stats> procs;
+    std::vector<trace_event> trace;
+    size_t   max_trace_events = 1u << 20;
+    uint64_t sample_mask      = 15;
+
+    // Clock edge accounting
+    uint64_t edges_seen   = 0;
+    uint64_t edges_done   = 0;      // edges whose time step has ended
+    uint64_t edge_delta0  = 0;      // sc_delta_count() at the open edge
+    uint64_t edge_sim_ps  = 0;
+    uint64_t edge_host    = 0;
+    uint64_t delta_sum    = 0;
+    uint64_t delta_min    = ~0ull;
+    uint64_t delta_max    = 0;
+    std::vector<uint64_t> delta_hist;   // deltas per edge, last bucket = overflow
+
+    // Host tick calibration
+    uint64_t tick0;
+    double   wall0_us;
+
+    double ticks_per_us() const;
+    void   record(const trace_event& ev);
+};
+
+// Scope probe placed at the top of an SC_METHOD
+class proc_probe {
+public:
+    explicit proc_probe(proc_stats* s) : stats(s) {
+        if (!stats) return;
+        timed = sim_profiler::instance().sample(stats);
+        ++stats->activations;
+        if (timed) t0 = host_ticks();
+    }
+
+    ~proc_probe() {
+        if (!stats) return;
+        if (!changed) ++stats->no_change;
+        if (timed) {
+            const uint64_t t1 = host_ticks();
+            ++stats->samples;
+            stats->sampled_ticks += t1 - t0;
+            sim_profiler::instance().trace_activation(stats, t0, t1);
+        }
+    }
+
+    // Write a port, noting whether its value changes
+    template <class T, class V>
+    void write(sc_out<T>& port, const V& v) {
+        const T nv = v;
+        if (!(port.read() == nv)) changed = true;
+        port.write(nv);
+    }
+
+    // Internal state updates (registers, latches)
+    void mark_changed(bool c = true) { changed = changed || c; }
+
+private:
+    proc_stats* stats;
+    bool        timed   = false;
+    bool        changed = false;
+    uint64_t    t0      = 0;
+};
+
+#else // !CANON_SIM_PROFILE
+
+class sim_profiler {
+public:
+    static sim_profiler& instance() { static sim_profiler p; return p; }
+
+    proc_stats* attach(const sc_module*, const char*) { return nullptr; }
+    void set_sample_shift(unsigned) {}
+    void set_max_trace_events(size_t) {}
+    void clock_edge() {}
+    void clock_edge_step_end() {}
+
+    void write_report(std::ostream& os) const { os << "sim_profiler: built without CANON_SIM_PROFILE\n"; }
+    bool write_chrome_trace(const std::string&) const { return false; }
+};
+
+class proc_probe {
+public:
+    explicit proc_probe(proc_stats*) {}
+
+    template <class T, class V>
+    void write(sc_out<T>& port, const V& v) { port.write(v); }
+
+    void mark_changed(bool = true) {}
+};
+
+#endif // CANON_SIM_PROFILE
+
+// Counts delta cycles in the time step of each rising clock edge.
+// The step is closed one time resolution later, the earliest point
+// at which simulation time has advanced past the edge.
+SC_MODULE(sim_edge_monitor) {
+    sc_in<bool> clk;
+
+    void edge_proc() {
+        sim_profiler::instance().clock_edge();
+        step_end.notify(sc_get_time_resolution());
+    }
+
+    void step_end_proc() { sim_profiler::instance().clock_edge_step_end(); }
+
+    SC_CTOR(sim_edge_monitor) {
+        SC_METHOD(edge_proc);
+        sensitive << clk.pos();
+        dont_initialize();
+
+        SC_METHOD(step_end_proc);
+        sensitive << step_end;
+        dont_initialize();
+    }
+
+private:
+    sc_event step_end;
+};
+
+#endif // SIM_PROFILER_H
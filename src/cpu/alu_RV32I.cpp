@@ -12,6 +12,8 @@
 
 
 void alu_RV32I::alu_process(void) {
+    proc_probe probe(prof_alu);
+
     // Read inputs
     const sc_uint<32> a      = data_a_in.read();          // rs1
     const sc_uint<32> b_rs2  = data_b_in.read();          // rs2 (for compares)
@@ -57,7 +59,7 @@ void alu_RV32I::alu_process(void) {
     }
 
     // ---- Drive outputs ----
-    result_out.write(res);
-    br_flags_out.write(flags);
-    target_out.write(res); // Always drive target_out with ALU result
+    probe.write(result_out, res);
+    probe.write(br_flags_out, flags);
+    probe.write(target_out, res); // Always drive target_out with ALU result
 }
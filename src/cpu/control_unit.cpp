@@ -7,15 +7,18 @@
 #include "control_unit.h"
 
 void control_unit::comb() {
+    proc_probe probe(prof_comb);
+
     // ---- Safe defaults (NOP) ----
     sc_uint<2> pc_op    = PC_PLUS4;
     sc_uint<2> mem_op   = MEM_NONE;
     sc_uint<3> mem_mode = 0;          
     bool       reg_we   = false;
     sc_uint<2> wb_sel   = WB_ALU;
+    sc_uint<2> sys_op   = SYS_NONE;
 
     // Unpack inputs
-    const sc_uint<5> op  = alu_op_in.read();
+    const sc_uint<OPCLASS_BITS> op = alu_op_in.read();
     const sc_uint<3> f3  = funct3_in.read();
     const bool eq   = br_flags_in.read()[0];
     const bool lt_s = br_flags_in.read()[1];
@@ -64,13 +67,13 @@ void control_unit::comb() {
 
         case OP_JAL:
             pc_op  = PC_JAL;
-            reg_we = true;            // rd = PC+4
+            reg_we = true;            // rd = PC+4 (PC+2 for C.JAL)
             wb_sel = WB_PC4;
             break;
 
         case OP_JALR:
             pc_op  = PC_JALR;
-            reg_we = true;            // rd = PC+4
+            reg_we = true;            // rd = PC+4 (PC+2 for C.JALR)
             wb_sel = WB_PC4;
             break;
 
@@ -86,15 +89,21 @@ void control_unit::comb() {
             wb_sel = WB_ALU;
             break;
 
+        case OP_SYSTEM:
+            // Decoder passes the SysOp subtype in funct3; PC advances normally
+            sys_op = f3.range(1,0);
+            break;
+
         default:
             // keep NOP defaults
             break;
     }
 
     // ---- Drive outputs ----
-    pc_op_out.write(pc_op);
-    mem_op_out.write(mem_op);
-    mem_mode_out.write(mem_mode);
-    reg_we_out.write(reg_we);
-    wb_sel_out.write(wb_sel);
+    probe.write(pc_op_out, pc_op);
+    probe.write(mem_op_out, mem_op);
+    probe.write(mem_mode_out, mem_mode);
+    probe.write(reg_we_out, reg_we);
+    probe.write(wb_sel_out, wb_sel);
+    probe.write(sys_op_out, sys_op);
 }
\ No newline at end of file
@@ -7,6 +7,8 @@
  #include "register_unit.h"
 
 void register_unit::comb_read() {
+    proc_probe probe(prof_read);
+
     sc_uint<5> a1 = rs1_addr_in.read();
     sc_uint<5> a2 = rs2_addr_in.read();
 
@@ -14,12 +16,16 @@ void register_unit::comb_read() {
     sc_uint<32> v1 = (a1 == 0) ? 0u : regs[a1];
     sc_uint<32> v2 = (a2 == 0) ? 0u : regs[a2];
 
-    data_a_out.write(v1);
-    data_b_out.write(v2);
+    probe.write(data_a_out, v1);
+    probe.write(data_b_out, v2);
 }
 
 void register_unit::comb_write() {
+    proc_probe probe(prof_write);
+
     if (we_in.read() && rd_addr_in.read() != 0) {
-        regs[rd_addr_in.read()] = wd_in.read();
+        const sc_uint<32> wd = wd_in.read();
+        probe.mark_changed(regs[rd_addr_in.read()] != wd);
+        regs[rd_addr_in.read()] = wd;
     }
 }
\ No newline at end of file
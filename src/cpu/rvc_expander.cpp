@@ -0,0 +1,215 @@
+/************************************************************
+ * Author: Mustafa Ergün
+ * Project: CANON MCU
+ * Submodule: RVC Expander
+ ************************************************************/
+
+#include "rvc_expander.h"
+
+// --------- small helpers ---------
+static inline uint32_t bits(uint32_t x, int hi, int lo) {
+    return (x >> lo) & ((1u << (hi - lo + 1)) - 1u);
+}
+
+static inline int32_t sext(uint32_t x, int from_bits) {
+    const int sh = 32 - from_bits;
+    return (int32_t)(x << sh) >> sh;
+}
+
+// Compressed 3-bit register fields address x8..x15
+static inline uint32_t creg(uint32_t f) { return f + 8; }
+
+// --------- RV32I encoders ---------
+static inline uint32_t enc_r(uint32_t f7, uint32_t rs2, uint32_t rs1,
+                             uint32_t f3, uint32_t rd, uint32_t op) {
+    return (f7 << 25) | (rs2 << 20) | (rs1 << 15) | (f3 << 12) | (rd << 7) | op;
+}
+
+static inline uint32_t enc_i(int32_t imm, uint32_t rs1, uint32_t f3,
+                             uint32_t rd, uint32_t op) {
+    return (((uint32_t)imm & 0xFFFu) << 20) | (rs1 << 15) | (f3 << 12) | (rd << 7) | op;
+}
+
+static inline uint32_t enc_s(int32_t imm, uint32_t rs2, uint32_t rs1,
+                             uint32_t f3, uint32_t op) {
+    const uint32_t u = (uint32_t)imm;
+    return (bits(u, 11, 5) << 25) | (rs2 << 20) | (rs1 << 15) | (f3 << 12) |
+           (bits(u, 4, 0) << 7) | op;
+}
+
+static inline uint32_t enc_b(int32_t imm, uint32_t rs2, uint32_t rs1, uint32_t f3) {
+    const uint32_t u = (uint32_t)imm;
+    return (bits(u, 12, 12) << 31) | (bits(u, 10, 5) << 25) | (rs2 << 20) |
+           (rs1 << 15) | (f3 << 12) | (bits(u, 4, 1) << 8) |
+           (bits(u, 11, 11) << 7) | 0b1100011u;
+}
+
+static inline uint32_t enc_u(int32_t imm, uint32_t rd, uint32_t op) {
+    return ((uint32_t)imm & 0xFFFFF000u) | (rd << 7) | op;
+}
+
+static inline uint32_t enc_j(int32_t imm, uint32_t rd) {
+    const uint32_t u = (uint32_t)imm;
+    return (bits(u, 20, 20) << 31) | (bits(u, 10, 1) << 21) |
+           (bits(u, 11, 11) << 20) | (bits(u, 19, 12) << 12) |
+           (rd << 7) | 0b1101111u;
+}
+
+// RV32I opcodes used by the expansions
+static constexpr uint32_t OP_LUI    = 0b0110111;
+static constexpr uint32_t OP_JALR   = 0b1100111;
+static constexpr uint32_t OP_LOAD   = 0b0000011;
+static constexpr uint32_t OP_STORE  = 0b0100011;
+static constexpr uint32_t OP_OPIMM  = 0b0010011;
+static constexpr uint32_t OP_OP     = 0b0110011;
+static constexpr uint32_t EBREAK    = 0x00100073;
+
+// --------- immediate layouts ---------
+// CI: imm[5] = c[12], imm[4:0] = c[6:2]
+static inline int32_t imm_ci(uint32_t c) {
+    return sext((bits(c, 12, 12) << 5) | bits(c, 6, 2), 6);
+}
+
+// CJ: offset[11|4|9:8|10|6|7|3:1|5] = c[12|11|10:9|8|7|6|5:3|2]
+static inline int32_t imm_cj(uint32_t c) {
+    const uint32_t raw =
+        (bits(c, 12, 12) << 11) | (bits(c, 11, 11) << 4) |
+        (bits(c, 10, 9)  << 8)  | (bits(c, 8, 8)   << 10) |
+        (bits(c, 7, 7)   << 6)  | (bits(c, 6, 6)   << 7) |
+        (bits(c, 5, 3)   << 1)  | (bits(c, 2, 2)   << 5);
+    return sext(raw, 12);
+}
+
+// CB: offset[8|4:3] = c[12|11:10], offset[7:6|2:1|5] = c[6:5|4:3|2]
+static inline int32_t imm_cb(uint32_t c) {
+    const uint32_t raw =
+        (bits(c, 12, 12) << 8) | (bits(c, 11, 10) << 3) |
+        (bits(c, 6, 5)   << 6) | (bits(c, 4, 3)   << 1) |
+        (bits(c, 2, 2)   << 5);
+    return sext(raw, 9);
+}
+
+// CL/CS word offset: uimm[5:3] = c[12:10], uimm[2] = c[6], uimm[6] = c[5]
+static inline int32_t imm_clw(uint32_t c) {
+    return (int32_t)((bits(c, 12, 10) << 3) | (bits(c, 6, 6) << 2) | (bits(c, 5, 5) << 6));
+}
+
+uint32_t rvc_expand(uint16_t cinst) {
+    const uint32_t c   = cinst;
+    const uint32_t q   = bits(c, 1, 0);
+    const uint32_t f3  = bits(c, 15, 13);
+    const uint32_t rd  = bits(c, 11, 7);   // also rs1 for CI/CR
+    const uint32_t rs2 = bits(c, 6, 2);
+    const uint32_t rdp = creg(bits(c, 4, 2));  // rd'/rs2'
+    const uint32_t rsp = creg(bits(c, 9, 7));  // rs1'/rd'
+
+    switch (q) {
+        // ---------------- Quadrant 0 ----------------
+        case 0b00:
+            switch (f3) {
+                case 0b000: { // C.ADDI4SPN -> addi rd', x2, nzuimm
+                    const uint32_t nzuimm =
+                        (bits(c, 12, 11) << 4) | (bits(c, 10, 7) << 6) |
+                        (bits(c, 6, 6)   << 2) | (bits(c, 5, 5)  << 3);
+                    if (nzuimm == 0) return 0; // reserved (incl. all-zero)
+                    return enc_i((int32_t)nzuimm, 2, 0b000, rdp, OP_OPIMM);
+                }
+                case 0b010: // C.LW -> lw rd', uimm(rs1')
+                    return enc_i(imm_clw(c), rsp, 0b010, rdp, OP_LOAD);
+                case 0b110: // C.SW -> sw rs2', uimm(rs1')
+                    return enc_s(imm_clw(c), rdp, rsp, 0b010, OP_STORE);
+                default:    // C.FLD/C.FLW/C.FSD/C.FSW: no F/D
+                    return 0;
+            }
+
+        // ---------------- Quadrant 1 ----------------
+        case 0b01:
+            switch (f3) {
+                case 0b000: // C.ADDI / C.NOP -> addi rd, rd, imm
+                    return enc_i(imm_ci(c), rd, 0b000, rd, OP_OPIMM);
+                case 0b001: // C.JAL (RV32 only) -> jal x1, offset
+                    return enc_j(imm_cj(c), 1);
+                case 0b010: // C.LI -> addi rd, x0, imm
+                    return enc_i(imm_ci(c), 0, 0b000, rd, OP_OPIMM);
+                case 0b011:
+                    if (rd == 2) { // C.ADDI16SP -> addi x2, x2, nzimm
+                        const uint32_t raw =
+                            (bits(c, 12, 12) << 9) | (bits(c, 6, 6) << 4) |
+                            (bits(c, 5, 5)   << 6) | (bits(c, 4, 3) << 7) |
+                            (bits(c, 2, 2)   << 5);
+                        if (raw == 0) return 0;
+                        return enc_i(sext(raw, 10), 2, 0b000, 2, OP_OPIMM);
+                    } else {       // C.LUI -> lui rd, nzimm
+                        const int32_t nzimm = imm_ci(c);
+                        if (nzimm == 0) return 0;
+                        return enc_u(nzimm << 12, rd, OP_LUI);
+                    }
+                case 0b100: {
+                    const uint32_t f2 = bits(c, 11, 10);
+                    switch (f2) {
+                        case 0b00: // C.SRLI
+                            if (bits(c, 12, 12)) return 0; // shamt[5] reserved on RV32
+                            return enc_r(0b0000000, rs2, rsp, 0b101, rsp, OP_OPIMM);
+                        case 0b01: // C.SRAI
+                            if (bits(c, 12, 12)) return 0;
+                            return enc_r(0b0100000, rs2, rsp, 0b101, rsp, OP_OPIMM);
+                        case 0b10: // C.ANDI
+                            return enc_i(imm_ci(c), rsp, 0b111, rsp, OP_OPIMM);
+                        default:
+                            if (bits(c, 12, 12)) return 0; // C.SUBW/C.ADDW: RV64 only
+                            switch (bits(c, 6, 5)) {
+                                case 0b00: return enc_r(0b0100000, rdp, rsp, 0b000, rsp, OP_OP); // C.SUB
+                                case 0b01: return enc_r(0b0000000, rdp, rsp, 0b100, rsp, OP_OP); // C.XOR
+                                case 0b10: return enc_r(0b0000000, rdp, rsp, 0b110, rsp, OP_OP); // C.OR
+                                default:   return enc_r(0b0000000, rdp, rsp, 0b111, rsp, OP_OP); // C.AND
+                            }
+                    }
+                }
+                case 0b101: // C.J -> jal x0, offset
+                    return enc_j(imm_cj(c), 0);
+                case 0b110: // C.BEQZ -> beq rs1', x0, offset
+                    return enc_b(imm_cb(c), 0, rsp, 0b000);
+                default:    // C.BNEZ -> bne rs1', x0, offset
+                    return enc_b(imm_cb(c), 0, rsp, 0b001);
+            }
+
+        // ---------------- Quadrant 2 ----------------
+        case 0b10:
+            switch (f3) {
+                case 0b000: // C.SLLI -> slli rd, rd, shamt
+                    if (bits(c, 12, 12)) return 0;
+                    return enc_r(0b0000000, rs2, rd, 0b001, rd, OP_OPIMM);
+                case 0b010: { // C.LWSP -> lw rd, uimm(x2)
+                    if (rd == 0) return 0;
+                    const uint32_t uimm =
+                        (bits(c, 12, 12) << 5) | (bits(c, 6, 4) << 2) | (bits(c, 3, 2) << 6);
+                    return enc_i((int32_t)uimm, 2, 0b010, rd, OP_LOAD);
+                }
+                case 0b100:
+                    if (!bits(c, 12, 12)) {
+                        if (rs2 == 0) { // C.JR -> jalr x0, 0(rs1)
+                            if (rd == 0) return 0;
+                            return enc_i(0, rd, 0b000, 0, OP_JALR);
+                        }
+                        // C.MV -> add rd, x0, rs2
+                        return enc_r(0b0000000, rs2, 0, 0b000, rd, OP_OP);
+                    } else {
+                        if (rs2 == 0) {
+                            if (rd == 0) return EBREAK;       // C.EBREAK
+                            return enc_i(0, rd, 0b000, 1, OP_JALR); // C.JALR -> jalr x1, 0(rs1)
+                        }
+                        // C.ADD -> add rd, rd, rs2
+                        return enc_r(0b0000000, rs2, rd, 0b000, rd, OP_OP);
+                    }
+                case 0b110: { // C.SWSP -> sw rs2, uimm(x2)
+                    const uint32_t uimm = (bits(c, 12, 9) << 2) | (bits(c, 8, 7) << 6);
+                    return enc_s((int32_t)uimm, rs2, 2, 0b010, OP_STORE);
+                }
+                default:    // C.FLDSP/C.FLWSP/C.FSDSP/C.FSWSP: no F/D
+                    return 0;
+            }
+
+        default: // 0b11: not a compressed instruction
+            return 0;
+    }
+}
@@ -0,0 +1,312 @@
+/************************************************************
+ * Author: Mustafa Ergün
+ * Project: CANON MCU
+ * Submodule: Semihosting Unit
+ ************************************************************/
+
+#include "semihost_unit.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// ADP_Stopped_ApplicationExit: normal termination reason for SYS_EXIT
+static constexpr uint32_t ADP_APP_EXIT = 0x20026;
+
+static constexpr uint32_t SH_ERROR = 0xFFFFFFFFu; // -1
+
+// --------- small helpers ---------
+static size_t write_all(int fd, const unsigned char* p, size_t len) {
+    size_t done = 0;
+    while (done < len) {
+        const ssize_t n = ::write(fd, p + done, len - done);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        done += (size_t)n;
+    }
+    return done;
+}
+
+// ================= buffered_writer =================
+
+buffered_writer::buffered_writer(int fd, size_t capacity) : fd(fd), buf(capacity) {}
+
+buffered_writer::~buffered_writer() { flush(); }
+
+size_t buffered_writer::write(const void* data, size_t len) {
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+
+    // Large writes bypass the buffer and go straight from guest memory
+    if (len >= buf.size()) {
+        flush();
+        return len - write_all(fd, p, len);
+    }
+    if (used + len > buf.size())
+        flush();
+
+    std::memcpy(buf.data() + used, p, len);
+    used += len;
+    return 0;
+}
+
+void buffered_writer::flush() {
+    if (used == 0) return;
+    write_all(fd, reinterpret_cast<const unsigned char*>(buf.data()), used);
+    used = 0;
+}
+
+// ================= semihost_unit =================
+
+semihost_unit::~semihost_unit() {
+    for (int fd : handles)
+        if (fd > 2) ::close(fd);
+}
+
+void semihost_unit::end_of_simulation() {
+    console.flush();
+}
+
+void semihost_unit::invalidate_dmi(sc_dt::uint64 start, sc_dt::uint64 end) {
+    dmi_regions.erase(
+        std::remove_if(dmi_regions.begin(), dmi_regions.end(), [&](const tlm::tlm_dmi& d) {
+            return d.get_start_address() <= end && d.get_end_address() >= start;
+        }),
+        dmi_regions.end());
+}
+
+unsigned char* semihost_unit::guest_ptr(uint32_t addr, uint32_t len, tlm::tlm_command cmd,
+                                        uint32_t* avail) {
+    for (const tlm::tlm_dmi& d : dmi_regions) {
+        const sc_dt::uint64 start = d.get_start_address();
+        const sc_dt::uint64 end   = d.get_end_address();   // inclusive
+        if (addr < start || addr > end) continue;
+
+        // Never write through a read-only region (e.g. flash)
+        const bool allowed = (cmd == tlm::TLM_WRITE_COMMAND) ? d.is_write_allowed()
+                                                             : d.is_read_allowed();
+        if (!allowed) continue;
+
+        const sc_dt::uint64 left = end - addr + 1;
+        if (len > left) return nullptr;
+        if (avail) *avail = (uint32_t)std::min<sc_dt::uint64>(left, 0xFFFFFFFFu);
+        return d.get_dmi_ptr() + (addr - start);
+    }
+    return nullptr;
+}
+
+bool semihost_unit::read_word(uint32_t addr, uint32_t& val) {
+    const unsigned char* p = guest_ptr(addr, 4, tlm::TLM_READ_COMMAND);
+    if (!p) return false;
+    val = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+    return true;
+}
+
+int semihost_unit::host_fd(uint32_t handle) const {
+    return (handle < handles.size()) ? handles[handle] : -1;
+}
+
+void semihost_unit::exec() {
+    const sc_uint<2> op = sys_op_in.read();
+    if ((op != SYS_ECALL && op != SYS_EBREAK) || !regs || has_exited)
+        return;
+
+    // EBREAK is only a semihosting call inside the slli/ebreak/srai sequence
+    if (op == SYS_EBREAK) {
+        const uint32_t pc = pc_in.read();
+        uint32_t pre = 0, post = 0;
+        if (!read_word(pc - 4, pre) || !read_word(pc + 4, post) ||
+            pre != SH_ENTRY_SLLI || post != SH_EXIT_SRAI)
+            return;
+    }
+
+    const uint32_t a0 = regs->read_reg(10);
+    const uint32_t a1 = regs->read_reg(11);
+    regs->write_reg(10, call(a0, a1));
+}
+
+uint32_t semihost_unit::call(uint32_t op, uint32_t arg) {
+    // Argument block words
+    uint32_t p0 = 0, p1 = 0, p2 = 0;
+    auto args = [&](int n) {
+        return (n < 1 || read_word(arg,     p0)) &&
+               (n < 2 || read_word(arg + 4, p1)) &&
+               (n < 3 || read_word(arg + 8, p2));
+    };
+
+    switch (op) {
+        case SH_SYS_OPEN:
+            return args(3) ? sys_open(p0, p1, p2) : SH_ERROR;
+
+        case SH_SYS_CLOSE: {
+            if (!args(1)) return SH_ERROR;
+            const int fd = host_fd(p0);
+            if (fd < 0) { host_errno = EBADF; return SH_ERROR; }
+            if (fd == 1) console.flush();
+            handles[p0] = -1;
+            if (fd > 2 && ::close(fd) != 0) { host_errno = errno; return SH_ERROR; }
+            return 0;
+        }
+
+        case SH_SYS_WRITEC: {
+            const unsigned char* c = guest_ptr(arg, 1, tlm::TLM_READ_COMMAND);
+            if (c) console.write(c, 1);
+            return 0;
+        }
+
+        case SH_SYS_WRITE0:
+            return sys_write0(arg);
+
+        case SH_SYS_WRITE:
+            return args(3) ? sys_write(p0, p1, p2) : SH_ERROR;
+
+        case SH_SYS_READ:
+            return args(3) ? sys_read(p0, p1, p2) : SH_ERROR;
+
+        case SH_SYS_READC: {
+            console.flush();
+            unsigned char c = 0;
+            return (::read(0, &c, 1) == 1) ? c : SH_ERROR;
+        }
+
+        case SH_SYS_ISERROR:
+            return args(1) ? (((int32_t)p0 < 0) ? 1u : 0u) : SH_ERROR;
+
+        case SH_SYS_ISTTY: {
+            if (!args(1)) return SH_ERROR;
+            const int fd = host_fd(p0);
+            return (fd >= 0 && ::isatty(fd)) ? 1u : 0u;
+        }
+
+        case SH_SYS_SEEK: {
+            if (!args(2)) return SH_ERROR;
+            const int fd = host_fd(p0);
+            if (fd < 0) { host_errno = EBADF; return SH_ERROR; }
+            if (::lseek(fd, (off_t)p1, SEEK_SET) < 0) { host_errno = errno; return SH_ERROR; }
+            return 0;
+        }
+
+        case SH_SYS_FLEN: {
+            if (!args(1)) return SH_ERROR;
+            struct stat st;
+            const int fd = host_fd(p0);
+            if (fd < 0 || ::fstat(fd, &st) != 0) { host_errno = (fd < 0) ? EBADF : errno; return SH_ERROR; }
+            return (uint32_t)st.st_size;
+        }
+
+        case SH_SYS_REMOVE: {
+            if (!args(2)) return SH_ERROR;
+            const char* name = reinterpret_cast<const char*>(guest_ptr(p0, p1, tlm::TLM_READ_COMMAND));
+            if (!name) { host_errno = EFAULT; return SH_ERROR; }
+            if (::unlink(std::string(name, p1).c_str()) != 0) { host_errno = errno; return SH_ERROR; }
+            return 0;
+        }
+
+        case SH_SYS_CLOCK:
+            // Centiseconds of simulated time, so runs are reproducible
+            return (uint32_t)(sc_time_stamp().to_seconds() * 100.0);
+
+        case SH_SYS_TIME:
+            return (uint32_t)std::time(nullptr);
+
+        case SH_SYS_ERRNO:
+            return (uint32_t)host_errno;
+
+        case SH_SYS_EXIT:
+            // RV32: a1 holds the reason code itself
+            sys_exit(arg, 0);
+            return 0;
+
+        case SH_SYS_EXIT_EXTENDED:
+            if (!args(2)) return SH_ERROR;
+            sys_exit(p0, p1);
+            return 0;
+
+        default:
+            return SH_ERROR;
+    }
+}
+
+uint32_t semihost_unit::sys_open(uint32_t name, uint32_t mode, uint32_t len) {
+    const char* p = reinterpret_cast<const char*>(guest_ptr(name, len, tlm::TLM_READ_COMMAND));
+    if (!p || mode > 11) { host_errno = !p ? EFAULT : EINVAL; return SH_ERROR; }
+    const std::string path(p, len);
+
+    int fd = -1;
+    if (path == ":tt") {
+        // r* = stdin, w* = stdout, a* = stderr
+        fd = (mode < 4) ? 0 : (mode < 8) ? 1 : 2;
+    } else {
+        // fopen modes r, rb, r+, r+b, w, wb, w+, w+b, a, ab, a+, a+b
+        static const int flags[6] = {
+            O_RDONLY, O_RDWR,
+            O_WRONLY | O_CREAT | O_TRUNC,  O_RDWR | O_CREAT | O_TRUNC,
+            O_WRONLY | O_CREAT | O_APPEND, O_RDWR | O_CREAT | O_APPEND
+        };
+        fd = ::open(path.c_str(), flags[mode / 2], 0644);
+        if (fd < 0) { host_errno = errno; return SH_ERROR; }
+    }
+
+    // Handle 0 is never issued (slot 0 stays -1)
+    for (size_t h = 1; h < handles.size(); ++h) {
+        if (handles[h] < 0) { handles[h] = fd; return (uint32_t)h; }
+    }
+    handles.push_back(fd);
+    return (uint32_t)(handles.size() - 1);
+}
+
+uint32_t semihost_unit::sys_write(uint32_t handle, uint32_t buf, uint32_t len) {
+    const int fd = host_fd(handle);
+    const unsigned char* p = guest_ptr(buf, len, tlm::TLM_READ_COMMAND);
+    if (fd < 0 || !p) { host_errno = (fd < 0) ? EBADF : EFAULT; return len; }
+
+    // Returns the number of bytes NOT written
+    if (fd == 1)
+        return (uint32_t)console.write(p, len);
+    if (fd == 2)
+        console.flush(); // keep stdout/stderr ordering
+    return len - (uint32_t)write_all(fd, p, len);
+}
+
+uint32_t semihost_unit::sys_read(uint32_t handle, uint32_t buf, uint32_t len) {
+    const int fd = host_fd(handle);
+    unsigned char* p = guest_ptr(buf, len, tlm::TLM_WRITE_COMMAND);  // host data into guest
+    if (fd < 0 || !p) { host_errno = (fd < 0) ? EBADF : EFAULT; return len; }
+
+    if (fd == 0)
+        console.flush(); // show any prompt before blocking
+
+    // Read straight into guest memory; returns the number of bytes NOT read
+    uint32_t done = 0;
+    while (done < len) {
+        const ssize_t n = ::read(fd, p + done, len - done);
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0) { host_errno = errno; break; }
+        if (n == 0) break;  // EOF
+        done += (uint32_t)n;
+        if (fd == 0) break; // interactive: return what is available
+    }
+    return len - done;
+}
+
+uint32_t semihost_unit::sys_write0(uint32_t str) {
+    uint32_t avail = 0;
+    const unsigned char* p = guest_ptr(str, 1, tlm::TLM_READ_COMMAND, &avail);
+    if (!p) { host_errno = EFAULT; return SH_ERROR; }
+
+    const void* nul = std::memchr(p, 0, avail);
+    const size_t len = nul ? (size_t)(static_cast<const unsigned char*>(nul) - p) : avail;
+    console.write(p, len);
+    return 0;
+}
+
+void semihost_unit::sys_exit(uint32_t reason, uint32_t subcode) {
+    console.flush();
+    has_exited  = true;
+    exit_status = (reason == ADP_APP_EXIT) ? (int)subcode : 1;
+    sc_stop();
+}
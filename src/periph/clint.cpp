@@ -0,0 +1,85 @@
+/************************************************************
+ * Author: Mustafa Ergün
+ * Project: CANON MCU
+ * Submodule: CLINT (Core-Local Interruptor)
+ ************************************************************/
+
+#include "clint.h"
+
+clint::clint(sc_module_name nm, const sc_time& tick)
+    : sc_module(nm), tick_period(tick) {
+    SC_METHOD(update_proc);
+    sensitive << update_ev << timer_ev;
+
+    msip_out.initialize(false);
+    mtip_out.initialize(false);
+}
+
+sc_dt::uint64 clint::mtime() const {
+    return mtime_offset + sc_time_stamp().value() / tick_period.value();
+}
+
+void clint::schedule_timer() {
+    timer_ev.cancel();
+
+    const sc_dt::uint64 now = mtime();
+    if (mtimecmp <= now) {
+        timer_ev.notify(SC_ZERO_TIME);
+        return;
+    }
+
+    // Absolute simulation time of the tick at which mtime == mtimecmp
+    const sc_dt::uint64 elapsed   = sc_time_stamp().value() / tick_period.value();
+    const sc_dt::uint64 remaining = mtimecmp - now;
+    const sc_dt::uint64 limit     = ~sc_dt::uint64(0) / tick_period.value();
+    if (remaining > limit - elapsed)
+        return; // beyond representable simulation time
+
+    const sc_dt::uint64 due = (elapsed + remaining) * tick_period.value();
+    timer_ev.notify(sc_time::from_value(due - sc_time_stamp().value()));
+}
+
+void clint::update_proc() {
+    msip_out.write(msip);
+    mtip_out.write(mtime() >= mtimecmp);
+}
+
+uint32_t clint::read(uint32_t offset) {
+    switch (offset) {
+        case CLINT_MSIP:        return msip ? 1u : 0u;
+        case CLINT_MTIMECMP_LO: return (uint32_t)mtimecmp;
+        case CLINT_MTIMECMP_HI: return (uint32_t)(mtimecmp >> 32);
+        case CLINT_MTIME_LO:    return (uint32_t)mtime();
+        case CLINT_MTIME_HI:    return (uint32_t)(mtime() >> 32);
+        default:                return 0;
+    }
+}
+
+void clint::write(uint32_t offset, uint32_t value) {
+    switch (offset) {
+        case CLINT_MSIP:
+            msip = value & 1u;
+            break;
+        case CLINT_MTIMECMP_LO:
+            mtimecmp = (mtimecmp & 0xFFFFFFFF00000000ull) | value;
+            break;
+        case CLINT_MTIMECMP_HI:
+            mtimecmp = (mtimecmp & 0x00000000FFFFFFFFull) | ((sc_dt::uint64)value << 32);
+            break;
+        case CLINT_MTIME_LO: {
+            const sc_dt::uint64 t = (mtime() & 0xFFFFFFFF00000000ull) | value;
+            mtime_offset = t - sc_time_stamp().value() / tick_period.value();
+            break;
+        }
+        case CLINT_MTIME_HI: {
+            const sc_dt::uint64 t = (mtime() & 0x00000000FFFFFFFFull) | ((sc_dt::uint64)value << 32);
+            mtime_offset = t - sc_time_stamp().value() / tick_period.value();
+            break;
+        }
+        default:
+            return;
+    }
+
+    schedule_timer();
+    update_ev.notify(SC_ZERO_TIME);
+}
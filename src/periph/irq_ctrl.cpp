@@ -0,0 +1,48 @@
+/************************************************************
+ * Author: Mustafa Ergün
+ * Project: CANON MCU
+ * Submodule: Interrupt Controller
+ ************************************************************/
+
+#include "irq_ctrl.h"
+
+uint32_t irq_ctrl::pending() const {
+    uint32_t p = ext_pending;
+    if (msip_in.read()) p |= 1u << IRQ_MSIP;
+    if (mtip_in.read()) p |= 1u << IRQ_MTIP;
+    return p;
+}
+
+void irq_ctrl::comb() {
+    // Latch rising edges on external lines
+    for (int i = 0; i < IRQ_LINES; ++i) {
+        if (ext_irq_in[i].posedge())
+            ext_pending |= 1u << (IRQ_EXT0 + i);
+    }
+
+    irq_pending_out.write((pending() & enable) != 0);
+}
+
+uint32_t irq_ctrl::read(uint32_t offset) {
+    switch (offset) {
+        case IRQ_PENDING: return pending();
+        case IRQ_ENABLE:  return enable;
+        default:          return 0;
+    }
+}
+
+void irq_ctrl::write(uint32_t offset, uint32_t value) {
+    switch (offset) {
+        case IRQ_PENDING:
+            // Level sources (MSIP/MTIP) are cleared at the CLINT
+            ext_pending &= ~(value & ~((1u << IRQ_EXT0) - 1u));
+            break;
+        case IRQ_ENABLE:
+            enable = value;
+            break;
+        default:
+            return;
+    }
+
+    update_ev.notify(SC_ZERO_TIME);
+}
@@ -0,0 +1,179 @@
+/************************************************************
+ * Author: Mustafa Ergün
+ * Project: CANON MCU
+ * Submodule: Simulation Profiler
+ ************************************************************/
+
+#include "sim_profiler.h"
+
+#ifdef CANON_SIM_PROFILE
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+static constexpr size_t DELTA_HIST_BUCKETS = 64;   // last bucket: >= 63 deltas
+
+// --------- small helpers ---------
+static double wall_us() {
+    return std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static std::string json_escape(const std::string& s) {
+    std::string out;
+    out.reserve(s.size());
+    for (char c : s) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+sim_profiler& sim_profiler::instance() {
+    static sim_profiler p;
+    return p;
+}
+
+sim_profiler::sim_profiler()
+    : delta_hist(DELTA_HIST_BUCKETS, 0), tick0(host_ticks()), wall0_us(wall_us()) {}
+
+proc_stats* sim_profiler::attach(const sc_module* owner, const char* proc) {
+    procs.emplace_back();
+    proc_stats& s = procs.back();
+    s.name = std::string(owner->name()) + "." + proc;
+    s.tid  = (uint32_t)procs.size();   // row 0 is the clock edge row
+    return &s;
+}
+
+void sim_profiler::record(const trace_event& ev) {
+    if (trace.size() < max_trace_events)
+        trace.push_back(ev);
+}
+
+void sim_profiler::trace_activation(const proc_stats* s, uint64_t t0, uint64_t t1) {
+    record({ t0, t1 - t0, sc_time_stamp().value(), s->tid, 0 });
+}
+
+void sim_profiler::clock_edge() {
+    ++edges_seen;
+    edge_delta0 = sc_delta_count();
+    edge_sim_ps = sc_time_stamp().value();
+    edge_host   = host_ticks();
+}
+
+void sim_profiler::clock_edge_step_end() {
+    // Deltas run at the edge's timestamp; the sample belongs to that edge
+    const uint64_t d = sc_delta_count() - edge_delta0;
+    ++edges_done;
+    delta_sum += d;
+    delta_min  = std::min(delta_min, d);
+    delta_max  = std::max(delta_max, d);
+    ++delta_hist[std::min<uint64_t>(d, DELTA_HIST_BUCKETS - 1)];
+    record({ edge_host, 0, edge_sim_ps, EDGE_TID, (uint32_t)d });
+}
+
+double sim_profiler::ticks_per_us() const {
+#if defined(__x86_64__) || defined(__i386__)
+    const double us = wall_us() - wall0_us;
+    if (us < 1.0) return 1000.0;
+    return (double)(host_ticks() - tick0) / us;
+#else
+    return 1000.0;  // host_ticks() is in ns
+#endif
+}
+
+void sim_profiler::write_report(std::ostream& out) const {
+    const double tpu = ticks_per_us();
+
+    // Format locally so the caller's stream flags are left untouched
+    std::ostringstream os;
+
+    // Sort by estimated host time
+    std::vector<const proc_stats*> sorted;
+    for (const proc_stats& s : procs) sorted.push_back(&s);
+    auto est_ticks = [](const proc_stats* s) {
+        return s->samples ? (double)s->sampled_ticks * s->activations / s->samples : 0.0;
+    };
+    std::sort(sorted.begin(), sorted.end(), [&](const proc_stats* a, const proc_stats* b) {
+        return est_ticks(a) > est_ticks(b);
+    });
+
+    os << "=== CANON simulation profile ===\n";
+    os << std::left << std::setw(48) << "process"
+       << std::right << std::setw(14) << "activations"
+       << std::setw(14) << "no-change"
+       << std::setw(8)  << "%"
+       << std::setw(12) << "est. ms"
+       << std::setw(10) << "ns/act" << "\n";
+
+    for (const proc_stats* s : sorted) {
+        const double pct = s->activations ? 100.0 * s->no_change / s->activations : 0.0;
+        const double us  = est_ticks(s) / tpu;
+        const double ns  = s->samples ? 1000.0 * s->sampled_ticks / s->samples / tpu : 0.0;
+        os << std::left << std::setw(48) << s->name
+           << std::right << std::setw(14) << s->activations
+           << std::setw(14) << s->no_change
+           << std::setw(8)  << std::fixed << std::setprecision(1) << pct
+           << std::setw(12) << std::setprecision(3) << us / 1000.0
+           << std::setw(10) << std::setprecision(1) << ns << "\n";
+    }
+
+    os << "\nclock edges: " << edges_seen;
+    if (edges_done) {
+        os << ", deltas/edge min " << delta_min
+           << " avg " << std::setprecision(2) << (double)delta_sum / edges_done
+           << " max " << delta_max << "\n";
+        os << "deltas/edge histogram:\n";
+        for (size_t i = 0; i < delta_hist.size(); ++i) {
+            if (!delta_hist[i]) continue;
+            os << "  " << std::setw(3) << i << (i == delta_hist.size() - 1 ? "+" : " ")
+               << std::setw(12) << delta_hist[i] << "\n";
+        }
+    } else {
+        os << "\n";
+    }
+    if (trace.size() >= max_trace_events)
+        os << "note: trace truncated at " << max_trace_events << " events\n";
+
+    out << os.str();
+}
+
+bool sim_profiler::write_chrome_trace(const std::string& path) const {
+    std::ofstream f(path);
+    if (!f) return false;
+
+    const double tpu = ticks_per_us();
+    f << std::fixed << std::setprecision(3);
+    f << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+
+    // One row per process, row 0 for clock edges
+    f << "{\"ph\":\"M\",\"pid\":0,\"tid\":" << EDGE_TID
+      << ",\"name\":\"thread_name\",\"args\":{\"name\":\"clock edges\"}}";
+    for (const proc_stats& s : procs) {
+        f << ",\n{\"ph\":\"M\",\"pid\":0,\"tid\":" << s.tid
+          << ",\"name\":\"thread_name\",\"args\":{\"name\":\"" << json_escape(s.name) << "\"}}";
+    }
+
+    for (const trace_event& ev : trace) {
+        const double ts = (double)(ev.host_t0 - tick0) / tpu;
+        if (ev.tid == EDGE_TID) {
+            f << ",\n{\"ph\":\"C\",\"pid\":0,\"tid\":0,\"name\":\"deltas/edge\",\"ts\":" << ts
+              << ",\"args\":{\"deltas\":" << ev.deltas << ",\"sim_ps\":" << ev.sim_ps << "}}";
+        } else {
+            const proc_stats& s = procs[ev.tid - 1];
+            f << ",\n{\"ph\":\"X\",\"pid\":0,\"tid\":" << ev.tid
+              << ",\"name\":\"" << json_escape(s.name) << "\",\"ts\":" << ts
+              << ",\"dur\":" << (double)ev.host_dur / tpu
+              << ",\"args\":{\"sim_ps\":" << ev.sim_ps << "}}";
+        }
+    }
+
+    f << "\n]}\n";
+    return (bool)f;
+}
+
+#endif // CANON_SIM_PROFILE